@@ -0,0 +1,67 @@
+/**
+ * @file bench_generator.c
+ * @brief Times generating puzzles for each difficulty tier.
+ * @author Harley Coughlin
+ * @copyright Copyright (c) 2025 Harley Coughlin
+ * @license MIT
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "../include/generator.h"
+#include "../include/rater.h"
+#include "../include/grid.h"
+
+#define puzzles_per_tier 20
+#define max_attempts 500
+
+static const char *tier_names[] = {
+    [technique_naked_single] = "naked single",
+    [technique_hidden_single] = "hidden single",
+    [technique_locked_candidates] = "locked candidates",
+    [technique_naked_subset] = "naked subset",
+    [technique_hidden_subset] = "hidden subset",
+};
+
+static double elapsed_ms(struct timespec start, struct timespec end) {
+    return ((double)(end.tv_sec - start.tv_sec) * 1e3) +
+           ((double)(end.tv_nsec - start.tv_nsec) / 1e6);
+}
+
+int main(void) {
+    srand(1);
+    uint8_t solution[grid_size];
+    uint8_t puzzle[grid_size];
+
+    printf("%-18s %6s %9s %10s %7s\n", "tier", "made", "attempts",
+           "ms/puzzle", "givens");
+    for (enum Technique tier = technique_naked_single;
+         tier <= technique_hidden_subset; tier++) {
+        size_t made = 0;
+        size_t attempts = 0;
+        size_t givens = 0;
+        struct timespec start, end;
+
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        while (made < puzzles_per_tier && attempts < max_attempts) {
+            attempts++;
+            generate_solution(solution);
+            if (!generate_puzzle(solution, puzzle, tier, tier)) {
+                continue;
+            }
+            made++;
+            for (size_t i = 0; i < grid_size; i++) {
+                givens += puzzle[i] != 0;
+            }
+        }
+        clock_gettime(CLOCK_MONOTONIC, &end);
+
+        printf("%-18s %6zu %9zu %10.2f %7.1f\n", tier_names[tier], made,
+               attempts, made ? elapsed_ms(start, end) / made : 0.0,
+               made ? (double)givens / made : 0.0);
+    }
+
+    return 0;
+}
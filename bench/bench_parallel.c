@@ -0,0 +1,77 @@
+/**
+ * @file bench_parallel.c
+ * @brief Compares the parallel search against the single threaded one.
+ * @author Harley Coughlin
+ * @copyright Copyright (c) 2025 Harley Coughlin
+ * @license MIT
+ */
+
+#include <stdio.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "../include/parallel.h"
+#include "../include/solver.h"
+#include "../include/grid.h"
+
+// Arto Inkala's "hardest sudoku", for the first solution.
+static const char *hard_puzzle =
+    "8..........36......7..9.2...5...7.......457.....1...3...1....68..85...1..9....4..";
+// The same puzzle with givens taken out, it has 914612 solutions to count.
+static const char *open_puzzle =
+    "...........36......7..9.2...5...7.......457.....1...3...1....68...5...1.........";
+#define first_repetitions 20
+
+static double elapsed_ms(struct timespec start, struct timespec end) {
+    return ((double)(end.tv_sec - start.tv_sec) * 1e3) +
+           ((double)(end.tv_nsec - start.tv_nsec) / 1e6);
+}
+
+int main(void) {
+    uint8_t puzzle[grid_size];
+    uint8_t solution[grid_size];
+    struct timespec start, end;
+    size_t found;
+
+    long online = sysconf(_SC_NPROCESSORS_ONLN);
+    size_t thread_counts[] = { 1, 2, 4, online > 0 ? (size_t)online : 1 };
+    size_t thread_configs = sizeof(thread_counts) / sizeof(thread_counts[0]);
+
+    parse_puzzle(hard_puzzle, puzzle);
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (size_t r = 0; r < first_repetitions; r++) {
+        found = solve_puzzle(engine_grid, puzzle, solution, 1);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    printf("first solution, sequential: %8.2f ms (%zu found)\n",
+           elapsed_ms(start, end) / first_repetitions, found);
+
+    for (size_t t = 0; t < thread_configs; t++) {
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        for (size_t r = 0; r < first_repetitions; r++) {
+            found = parallel_solve(puzzle, solution, parallel_first,
+                                   thread_counts[t]);
+        }
+        clock_gettime(CLOCK_MONOTONIC, &end);
+        printf("first solution, %2zu threads: %8.2f ms (%zu found)\n",
+               thread_counts[t], elapsed_ms(start, end) / first_repetitions,
+               found);
+    }
+
+    parse_puzzle(open_puzzle, puzzle);
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    found = solve_puzzle(engine_grid, puzzle, NULL, SIZE_MAX);
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    printf("count all, sequential:      %8.2f ms (%zu found)\n",
+           elapsed_ms(start, end), found);
+
+    for (size_t t = 0; t < thread_configs; t++) {
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        found = parallel_solve(puzzle, NULL, parallel_count, thread_counts[t]);
+        clock_gettime(CLOCK_MONOTONIC, &end);
+        printf("count all, %2zu threads:      %8.2f ms (%zu found)\n",
+               thread_counts[t], elapsed_ms(start, end), found);
+    }
+
+    return 0;
+}
@@ -0,0 +1,81 @@
+/**
+ * @file bench_solvers.c
+ * @brief Compares the solving engines on a handful of known puzzles.
+ *
+ * Both engines place naked and hidden singles before branching, so the times
+ * compare the board representations rather than the amount of propagation.
+ * @author Harley Coughlin
+ * @copyright Copyright (c) 2025 Harley Coughlin
+ * @license MIT
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "../include/solver.h"
+#include "../include/grid.h"
+
+static const char *puzzles[] = {
+    // Easy, solved by singles alone.
+    "..3.2.6..9..3.5..1..18.64....81.29..7.......8..67.82....26.95..8..2.3..9..5.1.3..",
+    // Arto Inkala's "hardest sudoku".
+    "8..........36......7..9.2...5...7.......457.....1...3...1....68..85...1..9....4..",
+    // Peter Norvig's hard1.
+    "4.....8.5.3..........7......2.....6.....8.4......1.......6.3.7.5..2.....1.4......",
+    // A 17 clue puzzle.
+    "000000010400000000020000000000050407008000300001090000300400200050100000000806000",
+    // Peter Norvig's hardest from his essay.
+    "..53.....8......2..7..1.5..4....53...1..7...6..32...8..6.5....9..4....3......97..",
+};
+#define puzzle_count (sizeof(puzzles) / sizeof(puzzles[0]))
+#define repetitions 50
+
+static double elapsed_us(struct timespec start, struct timespec end) {
+    return ((double)(end.tv_sec - start.tv_sec) * 1e6) +
+           ((double)(end.tv_nsec - start.tv_nsec) / 1e3);
+}
+
+int main(void) {
+    const enum SolverEngine engines[] = { engine_grid, engine_bitboard };
+    const char *names[] = { "grid", "bitboard" };
+
+    uint8_t puzzle[grid_size];
+    uint8_t solutions[2][grid_size];
+
+    printf("%-8s %13s %13s %9s\n", "puzzle", "grid (us)", "bitboard (us)",
+           "speedup");
+    for (size_t p = 0; p < puzzle_count; p++) {
+        if (!parse_puzzle(puzzles[p], puzzle)) {
+            fprintf(stderr, "Could not parse puzzle %zu\n", p);
+            return 1;
+        }
+
+        double times[2];
+        for (size_t e = 0; e < 2; e++) {
+            struct timespec start, end;
+            size_t found = 0;
+            clock_gettime(CLOCK_MONOTONIC, &start);
+            for (size_t r = 0; r < repetitions; r++) {
+                // Ask for two so the search has to prove uniqueness.
+                found = solve_puzzle(engines[e], puzzle, solutions[e], 2);
+            }
+            clock_gettime(CLOCK_MONOTONIC, &end);
+            if (found != 1) {
+                fprintf(stderr, "Engine %s found %zu solutions for puzzle "
+                                "%zu\n", names[e], found, p);
+                return 1;
+            }
+            times[e] = elapsed_us(start, end) / repetitions;
+        }
+
+        if (memcmp(solutions[0], solutions[1], grid_size) != 0) {
+            fprintf(stderr, "Engines disagree on puzzle %zu\n", p);
+            return 1;
+        }
+        printf("%-8zu %13.1f %13.1f %8.1fx\n", p, times[0], times[1],
+               times[0] / times[1]);
+    }
+
+    return 0;
+}
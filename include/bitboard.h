@@ -0,0 +1,92 @@
+/**
+ * @file bitboard.h
+ * @brief Digit-major sudoku board using one 81-bit bitboard per digit.
+ * @author Harley Coughlin
+ * @copyright Copyright (c) 2025 Harley Coughlin
+ * @license MIT
+ */
+
+#ifndef INCLUDE_BITBOARD_H_
+#define INCLUDE_BITBOARD_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#define band_count 3
+#define band_size 27
+#define band_mask 0x7FFFFFFu
+#define bitboard_digits 9
+
+/**
+ * @struct Bitboard
+ * @brief Candidate positions stored per digit instead of per cell.
+ *
+ * @details Each digit gets an 81-bit board split into three bands of three
+ *          rows. A band is 27 bits wide and lives in the low bits of a
+ *          uint32_t, bit (row_in_band * 9 + col) is the cell. Since a band
+ *          holds whole rows and whole nondrants, a row or nondrant is a single
+ *          mask within one band and a column is the same mask in all three.
+ *
+ *          A placed digit keeps its own bit, so every row/col/nondrant of
+ *          every digit must always have at least one bit set.
+ */
+struct Bitboard {
+    /** Candidate positions for each digit, digits[0] is digit one. */
+    uint32_t digits[bitboard_digits][band_count];
+
+    /** Cells that haven't had a digit placed yet. */
+    uint32_t unsolved[band_count];
+};
+
+/**
+ * @brief Bitboard_initialize gives every cell every digit.
+ */
+void bitboard_initialize(struct Bitboard *board);
+
+/**
+ * @brief Bitboard_place places a digit and eliminates it from its peers.
+ *
+ * @details Clears the digit from the row and nondrant within the band and
+ *          from the column in every band, then clears every other digit
+ *          from the cell.
+ *
+ * @param board The board to place the digit on.
+ * @param index The index of the cell (0-80).
+ * @param digit The digit to place (1-9).
+ * @returns false if the digit is not a candidate for the cell.
+ */
+bool bitboard_place(struct Bitboard *board, size_t index, uint8_t digit);
+
+/**
+ * @brief Bitboard_load_puzzle places the givens of a puzzle.
+ * @param board The board, it gets initialized before loading.
+ * @param puzzle grid_size values, 0 for an empty cell.
+ * @returns false if a given contradicts an earlier one.
+ */
+bool bitboard_load_puzzle(struct Bitboard *board, const uint8_t puzzle[]);
+
+/**
+ * @brief Bitboard_propagate places naked and hidden singles until stuck.
+ * @returns false if the board has reached a contradiction.
+ */
+bool bitboard_propagate(struct Bitboard *board);
+
+/**
+ * @brief Bitboard_to_digits writes the digit placed in each cell.
+ * @param board The board to read.
+ * @param digits Buffer of grid_size values, 0 for an unsolved cell.
+ */
+void bitboard_to_digits(const struct Bitboard *board, uint8_t digits[]);
+
+/**
+ * @brief Bitboard_solve solves a puzzle with the digit-major engine.
+ * @param puzzle grid_size values, 0 for an empty cell.
+ * @param solution Receives the first solution found, may be NULL.
+ * @param limit Stop searching once this many solutions have been found.
+ * @returns The number of solutions found, at most limit.
+ */
+size_t bitboard_solve(const uint8_t puzzle[], uint8_t solution[],
+                      size_t limit);
+
+#endif  // INCLUDE_BITBOARD_H_
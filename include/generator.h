@@ -0,0 +1,50 @@
+/**
+ * @file generator.h
+ * @brief Sudoku puzzle generation to a difficulty tier.
+ * @author Harley Coughlin
+ * @copyright Copyright (c) 2025 Harley Coughlin
+ * @license MIT
+ */
+
+#ifndef INCLUDE_GENERATOR_H_
+#define INCLUDE_GENERATOR_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#include "./rater.h"
+
+/**
+ * @brief Generate_solution fills a random, complete grid.
+ *
+ * @details The three nondrants on the diagonal don't share a row or column,
+ *          so they get shuffled values and the solver fills in the rest.
+ *
+ * @param solution Buffer of grid_size values.
+ * @note Uses rand(), seed it with srand() first.
+ */
+void generate_solution(uint8_t solution[]);
+
+/**
+ * @brief Generate_puzzle takes givens out of a solution until the puzzle
+ *        needs techniques between min and max.
+ *
+ * @details Cells are tried in a random order. Each candidate puzzle goes
+ *          through rate_filter, so one that needs more than max is put back
+ *          as soon as the cheaper techniques stall. Every puzzle kept is
+ *          solvable with techniques up to max, so it has a unique solution
+ *          without asking the solver.
+ *
+ * @param solution A complete grid of grid_size values.
+ * @param puzzle Buffer of grid_size values, 0 for an empty cell.
+ * @param min The cheapest technique the puzzle should need.
+ * @param max The most expensive technique the puzzle may need.
+ * @returns true if the puzzle landed within min and max, false if it stayed
+ *          under min after every cell was tried.
+ * @note Uses rand(), seed it with srand() first.
+ */
+bool generate_puzzle(const uint8_t solution[], uint8_t puzzle[],
+                     enum Technique min, enum Technique max);
+
+#endif  // INCLUDE_GENERATOR_H_
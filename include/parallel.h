@@ -0,0 +1,50 @@
+/**
+ * @file parallel.h
+ * @brief Multithreaded work-splitting search for a single puzzle.
+ * @author Harley Coughlin
+ * @copyright Copyright (c) 2025 Harley Coughlin
+ * @license MIT
+ */
+
+#ifndef INCLUDE_PARALLEL_H_
+#define INCLUDE_PARALLEL_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+/**
+ * @enum ParallelMode
+ * @brief What the workers are searching for.
+ */
+enum ParallelMode {
+    /** Stop every worker as soon as one of them finds a solution. */
+    parallel_first,
+    /** Visit the whole tree and count every solution. */
+    parallel_count
+};
+
+/**
+ * @brief Parallel_solve searches a puzzle with several threads.
+ *
+ * @details The search runs on struct Grid like engine_grid. Whenever a worker
+ *          is idle, a busy worker splits off the other values of the cell it
+ *          is branching on, from get_entropy_values(), as tasks holding their
+ *          own copy of the cells. Each worker keeps its tasks in its own
+ *          deque, works on the newest one and idle workers steal the oldest.
+ *          Workers that find nothing to steal sleep on a condition variable
+ *          until new tasks are queued or the search ends.
+ *
+ * @param puzzle grid_size values, 0 for an empty cell.
+ * @param solution Receives the solution found in parallel_first mode, or the
+ *        first one found in parallel_count mode. May be NULL.
+ * @param mode Whether to stop at the first solution or count them all.
+ * @param thread_count The amount of worker threads, 0 uses one per online
+ *        processor.
+ * @returns The number of solutions found, at most 1 for parallel_first.
+ * @note Returns 0 if the puzzle contradicts itself, is NULL, or the workers
+ *       could not be set up.
+ */
+size_t parallel_solve(const uint8_t puzzle[], uint8_t solution[],
+                      enum ParallelMode mode, size_t thread_count);
+
+#endif  // INCLUDE_PARALLEL_H_
@@ -0,0 +1,92 @@
+/**
+ * @file rater.h
+ * @brief Technique based sudoku difficulty rating.
+ * @author Harley Coughlin
+ * @copyright Copyright (c) 2025 Harley Coughlin
+ * @license MIT
+ */
+
+#ifndef INCLUDE_RATER_H_
+#define INCLUDE_RATER_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "./grid.h"
+
+/**
+ * @enum Technique
+ * @brief Solving techniques from cheapest to most expensive, a puzzle is
+ *        rated by the most expensive one it needs.
+ *
+ * @details Subsets are tried by size, naked before hidden at each size, so a
+ *          hidden pair is found before a naked triple or quad.
+ */
+enum Technique {
+    /** Nothing left to solve. */
+    technique_none,
+    /** A cell has one value left. */
+    technique_naked_single,
+    /** A value has one cell left in a row/col/nondrant. */
+    technique_hidden_single,
+    /** Pointing pairs/triples and box/line reduction. */
+    technique_locked_candidates,
+    /** Two to four cells of a unit that share as many values. */
+    technique_naked_subset,
+    /** Two to four values of a unit that share as many cells. */
+    technique_hidden_subset,
+    /** The techniques above are not enough, or the puzzle is broken. */
+    technique_beyond
+};
+
+/**
+ * @enum RateVerdict
+ * @brief Where a puzzle lands compared to a target range of techniques.
+ */
+enum RateVerdict { rate_under, rate_within, rate_over };
+
+/**
+ * @brief Rate_grid solves a grid using only the techniques up to a ceiling.
+ *
+ * @details Always applies the cheapest technique that makes progress and goes
+ *          back to the cheapest after every step, so the hardest technique
+ *          used is the hardest one the puzzle actually needs. Stops as soon
+ *          as every cell is collapsed, and gives up as soon as the cheapest
+ *          technique that makes progress is above the ceiling, so the rating
+ *          never depends on the ceiling.
+ *
+ * @param grid A grid with the givens collapsed, it is solved in place.
+ * @param ceiling The most expensive technique to try.
+ * @returns The hardest technique needed, technique_beyond if the techniques
+ *          up to the ceiling could not solve the grid.
+ * @note A puzzle solved this way has exactly one solution, every step
+ *       follows from the givens.
+ */
+enum Technique rate_grid(struct Grid *grid, enum Technique ceiling);
+
+/**
+ * @brief Rate_puzzle rates a puzzle using every technique.
+ * @param puzzle grid_size values, 0 for an empty cell.
+ * @returns The hardest technique needed, technique_beyond if the puzzle
+ *          needs more than the rater knows or contradicts itself.
+ */
+enum Technique rate_puzzle(const uint8_t puzzle[]);
+
+/**
+ * @brief Rate_filter checks whether a puzzle lands in a range of techniques.
+ *
+ * @details Stops as soon as the cheapest technique that makes progress is
+ *          above max, so a puzzle that is too hard is thrown out without
+ *          solving the rest of it.
+ *
+ * @param puzzle grid_size values, 0 for an empty cell.
+ * @param min The cheapest technique the puzzle should need.
+ * @param max The most expensive technique the puzzle may need.
+ * @returns rate_over if the puzzle needs more than max (or has no unique
+ *          solution), rate_under if it needs less than min, rate_within
+ *          otherwise.
+ */
+enum RateVerdict rate_filter(const uint8_t puzzle[], enum Technique min,
+                             enum Technique max);
+
+#endif  // INCLUDE_RATER_H_
@@ -0,0 +1,101 @@
+/**
+ * @file solver.h
+ * @brief Sudoku puzzle solving interface.
+ * @author Harley Coughlin
+ * @copyright Copyright (c) 2025 Harley Coughlin
+ * @license MIT
+ */
+
+#ifndef INCLUDE_SOLVER_H_
+#define INCLUDE_SOLVER_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#include "./grid.h"
+#include "./cell.h"
+
+/**
+ * @enum SolverEngine
+ * @brief Selects the board representation used to solve a puzzle.
+ */
+enum SolverEngine {
+    /** Cell-major search on top of struct Grid and propagate_collapse. */
+    engine_grid,
+    /** Digit-major search on nine 81-bit bitboards (see bitboard.h). */
+    engine_bitboard
+};
+
+/**
+ * @enum SearchState
+ * @brief The state of a grid after its forced moves have been applied.
+ */
+enum SearchState { search_dead_end, search_solved, search_branch };
+
+/**
+ * @brief Parse_puzzle reads an 81 character puzzle string.
+ *
+ * @details Digits 1-9 are givens, '0' and '.' are empty cells. Any other
+ *          character makes the string invalid.
+ *
+ * @param str The puzzle string, read row by row.
+ * @param puzzle Buffer of grid_size values, 0 for an empty cell.
+ * @returns true if the string held a full puzzle, false otherwise.
+ */
+bool parse_puzzle(const char *str, uint8_t puzzle[]);
+
+/**
+ * @brief Solve_puzzle solves a puzzle with the selected engine.
+ *
+ * @param engine The engine to solve the puzzle with.
+ * @param puzzle grid_size values, 0 for an empty cell.
+ * @param solution Buffer of grid_size values that receives the first
+ *        solution found. May be NULL if only the count is wanted.
+ * @param limit Stop searching once this many solutions have been found.
+ * @returns The number of solutions found, at most limit.
+ * @note Returns 0 if the puzzle contradicts itself or is NULL.
+ */
+size_t solve_puzzle(enum SolverEngine engine, const uint8_t puzzle[],
+                    uint8_t solution[], size_t limit);
+
+/**
+ * @brief Grid_load_puzzle collapses the givens of a puzzle into the grid.
+ * @param grid An initialized grid, it gets reset before loading.
+ * @param puzzle grid_size values, 0 for an empty cell.
+ * @returns false if a given contradicts an earlier one.
+ */
+bool grid_load_puzzle(struct Grid *grid, const uint8_t puzzle[]);
+
+/**
+ * @brief Grid_place collapses a cell and propagates the collapse.
+ * @param grid The grid in which the cell resides.
+ * @param index The index of the cell within grid->cells.
+ * @param entropy The value to collapse the cell to.
+ * @returns false if the value was not available to the cell.
+ */
+bool grid_place(struct Grid *grid, size_t index, enum Entropy entropy);
+
+/**
+ * @brief Grid_settle collapses every cell that is forced.
+ *
+ * @details Collapses naked singles, then hidden singles once there are no
+ *          naked singles left, the same propagation engine_bitboard does.
+ *          When neither is left it picks the uncollapsed cell with the least
+ *          entropy to branch on.
+ *
+ * @param grid The grid to settle.
+ * @param branch_cell Receives the cell to branch on for search_branch.
+ * @returns search_dead_end if a cell ran out of entropy, search_solved if
+ *          every cell is collapsed, search_branch otherwise.
+ */
+enum SearchState grid_settle(struct Grid *grid, size_t *branch_cell);
+
+/**
+ * @brief Grid_to_digits writes the value of each collapsed cell.
+ * @param grid The grid to read.
+ * @param digits Buffer of grid_size values, 0 for an uncollapsed cell.
+ */
+void grid_to_digits(struct Grid *grid, uint8_t digits[]);
+
+#endif  // INCLUDE_SOLVER_H_
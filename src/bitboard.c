@@ -0,0 +1,337 @@
+/**
+ * @file bitboard.c
+ * @brief Digit-major sudoku board implementation.
+ * @author Harley Coughlin
+ * @copyright Copyright (c) 2025 Harley Coughlin
+ * @license MIT
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "../include/bitboard.h"
+#include "../include/grid.h"
+#include "./search.h"
+
+// Masks for a unit within a band, shift by the row/col/nondrant to use them.
+#define row_unit_mask 0x1FFu
+#define col_unit_mask 0x40201u
+#define non_unit_mask 0x1C0E07u
+// The top left cell of each nondrant in a band.
+#define non_fold_mask 0x49u
+
+static void bitboard_search(const struct Bitboard *board,
+                            struct Search *search);
+
+/**
+ * @brief Clears a digit from the peers of a cell and every other digit from
+ *        the cell itself.
+ */
+static inline void place_bit(struct Bitboard *board, size_t band, uint32_t bit,
+                             size_t digit) {
+    uint32_t pos = (uint32_t)__builtin_ctz(bit);
+    uint32_t row = row_unit_mask << ((pos / 9) * 9);
+    uint32_t col = col_unit_mask << (pos % 9);
+    uint32_t non = non_unit_mask << (((pos % 9) / 3) * 3);
+
+    uint32_t *bands = board->digits[digit];
+    bands[0] &= ~col;
+    bands[1] &= ~col;
+    bands[2] &= ~col;
+    bands[band] &= ~(row | non);
+    bands[band] |= bit;
+
+    for (size_t d = 0; d < bitboard_digits; d++) {
+        if (d != digit) {
+            board->digits[d][band] &= ~bit;
+        }
+    }
+    board->unsolved[band] &= ~bit;
+}
+
+void bitboard_initialize(struct Bitboard *board) {
+    for (size_t b = 0; b < band_count; b++) {
+        for (size_t d = 0; d < bitboard_digits; d++) {
+            board->digits[d][b] = band_mask;
+        }
+        board->unsolved[b] = band_mask;
+    }
+}
+
+bool bitboard_place(struct Bitboard *board, size_t index, uint8_t digit) {
+    if (board == NULL || index >= grid_size || digit == 0 || digit > 9) {
+        return false;
+    }
+
+    size_t band = index / band_size;
+    uint32_t bit = 1u << (index % band_size);
+    if (!(board->unsolved[band] & bit) ||
+        !(board->digits[digit - 1][band] & bit)) {
+        return false;
+    }
+
+    place_bit(board, band, bit, digit - 1);
+    return true;
+}
+
+bool bitboard_load_puzzle(struct Bitboard *board, const uint8_t puzzle[]) {
+    if (board == NULL || puzzle == NULL) {
+        return false;
+    }
+
+    bitboard_initialize(board);
+    for (size_t i = 0; i < grid_size; i++) {
+        if (puzzle[i] != 0 && !bitboard_place(board, i, puzzle[i])) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * @brief Places every cell with a single candidate, a band at a time.
+ * @returns -1 on a contradiction, otherwise the amount placed.
+ */
+static int place_naked_singles(struct Bitboard *board) {
+    int placed = 0;
+    for (size_t b = 0; b < band_count; b++) {
+        // Bit-sliced count of the candidates of every cell in the band.
+        uint32_t ones = 0;
+        uint32_t twos = 0;
+        for (size_t d = 0; d < bitboard_digits; d++) {
+            uint32_t x = board->digits[d][b] & board->unsolved[b];
+            twos |= ones & x;
+            ones |= x;
+        }
+
+        if (board->unsolved[b] & ~ones) {
+            return -1;
+        }
+
+        uint32_t singles = ones & ~twos;
+        for (size_t d = 0; d < bitboard_digits && singles; d++) {
+            uint32_t mine = singles & board->digits[d][b];
+            singles &= ~mine;
+            while (mine) {
+                uint32_t bit = mine & -mine;
+                mine &= mine - 1;
+                // An earlier single may have taken this one's last digit,
+                // the next pass picks that up as a contradiction.
+                if (board->digits[d][b] & board->unsolved[b] & bit) {
+                    place_bit(board, b, bit, d);
+                    placed++;
+                }
+            }
+        }
+    }
+
+    return placed;
+}
+
+/**
+ * @brief Adds a mask to a bit-sliced count that saturates at two.
+ */
+static inline void tally(uint32_t x, uint32_t *ones, uint32_t *twos) {
+    *twos |= *ones & x;
+    *ones |= x;
+}
+
+/**
+ * @brief Places digits that have a single home left in a row/col/nondrant.
+ *
+ * @details Folds the units of a digit onto each other with shifts so every
+ *          row, column, and nondrant gets counted at once. Rows of a band
+ *          fold onto bits 0/9/18, nondrants onto bits 0/3/6, and the nine
+ *          rows of the board onto bits 0-8 for the columns. Multiplying a
+ *          folded mask by the unit mask spreads it back over the whole unit.
+ *
+ * @returns -1 if some unit of a digit has no home left, otherwise the
+ *          amount placed.
+ */
+static int place_hidden_singles(struct Bitboard *board) {
+    int placed = 0;
+    for (size_t d = 0; d < bitboard_digits; d++) {
+        uint32_t *bands = board->digits[d];
+
+        uint32_t col_ones = 0;
+        uint32_t col_twos = 0;
+        for (size_t b = 0; b < band_count; b++) {
+            for (size_t r = 0; r < 3; r++) {
+                tally((bands[b] >> (r * 9)) & row_unit_mask, &col_ones,
+                      &col_twos);
+            }
+        }
+        if (col_ones != row_unit_mask) {
+            return -1;
+        }
+        uint32_t col_singles = (col_ones & ~col_twos) * col_unit_mask;
+
+        uint32_t singles[band_count];
+        for (size_t b = 0; b < band_count; b++) {
+            uint32_t x = bands[b];
+            uint32_t row_ones = 0;
+            uint32_t row_twos = 0;
+            uint32_t non_ones = 0;
+            uint32_t non_twos = 0;
+            for (size_t k = 0; k < grid_width; k++) {
+                tally((x >> k) & col_unit_mask, &row_ones, &row_twos);
+                tally((x >> (((k / 3) * 9) + (k % 3))) & non_fold_mask, &non_ones,
+                      &non_twos);
+            }
+            if (row_ones != col_unit_mask || non_ones != non_fold_mask) {
+                return -1;
+            }
+
+            singles[b] = x & board->unsolved[b] &
+                ((row_ones & ~row_twos) * row_unit_mask |
+                 (non_ones & ~non_twos) * non_unit_mask | col_singles);
+        }
+
+        for (size_t b = 0; b < band_count; b++) {
+            while (singles[b]) {
+                uint32_t bit = singles[b] & -singles[b];
+                singles[b] &= singles[b] - 1;
+                // An earlier single of this digit may have shared a unit
+                // and cleared it, the next pass reports the empty unit.
+                if (bands[b] & board->unsolved[b] & bit) {
+                    place_bit(board, b, bit, d);
+                    placed++;
+                }
+            }
+        }
+    }
+
+    return placed;
+}
+
+bool bitboard_propagate(struct Bitboard *board) {
+    for (;;) {
+        int placed = place_naked_singles(board);
+        if (placed < 0) {
+            return false;
+        }
+        if (placed > 0) {
+            continue;
+        }
+
+        placed = place_hidden_singles(board);
+        if (placed <= 0) {
+            return placed == 0;
+        }
+    }
+}
+
+void bitboard_to_digits(const struct Bitboard *board, uint8_t digits[]) {
+    for (size_t i = 0; i < grid_size; i++) {
+        digits[i] = 0;
+    }
+
+    for (size_t b = 0; b < band_count; b++) {
+        uint32_t solved = ~board->unsolved[b] & band_mask;
+        for (size_t d = 0; d < bitboard_digits; d++) {
+            uint32_t x = board->digits[d][b] & solved;
+            while (x) {
+                digits[(b * band_size) + __builtin_ctz(x)] = (uint8_t)(d + 1);
+                x &= x - 1;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Picks the unsolved cell with the fewest candidates.
+ * @returns true with band/bit set, false if every cell is solved.
+ */
+static bool pick_branch_cell(const struct Bitboard *board, size_t *band,
+                             uint32_t *bit) {
+    size_t best_count = bitboard_digits + 1;
+    for (size_t b = 0; b < band_count; b++) {
+        uint32_t ones = 0;
+        uint32_t twos = 0;
+        uint32_t threes = 0;
+        for (size_t d = 0; d < bitboard_digits; d++) {
+            uint32_t x = board->digits[d][b] & board->unsolved[b];
+            threes |= twos & x;
+            twos |= ones & x;
+            ones |= x;
+        }
+
+        // Cells with exactly two candidates are as good as it gets after
+        // propagation, so take the first one straight away.
+        uint32_t pairs = twos & ~threes;
+        if (pairs) {
+            *band = b;
+            *bit = pairs & -pairs;
+            return true;
+        }
+
+        uint32_t x = board->unsolved[b];
+        while (x) {
+            uint32_t cell = x & -x;
+            x &= x - 1;
+            size_t count = 0;
+            for (size_t d = 0; d < bitboard_digits; d++) {
+                count += (board->digits[d][b] & cell) != 0;
+            }
+            if (count < best_count) {
+                best_count = count;
+                *band = b;
+                *bit = cell;
+            }
+        }
+    }
+
+    return best_count <= bitboard_digits;
+}
+
+/**
+ * @brief Depth first search, each branch works on its own copy of the board.
+ */
+static void bitboard_search(const struct Bitboard *board,
+                            struct Search *search) {
+    size_t band;
+    uint32_t bit;
+    if (!pick_branch_cell(board, &band, &bit)) {
+        if (search->count == 0 && search->solution != NULL) {
+            bitboard_to_digits(board, search->solution);
+        }
+        search->count++;
+        return;
+    }
+
+    for (size_t d = 0; d < bitboard_digits; d++) {
+        if (!(board->digits[d][band] & bit)) {
+            continue;
+        }
+
+        struct Bitboard next = *board;
+        place_bit(&next, band, bit, d);
+        if (!bitboard_propagate(&next)) {
+            continue;
+        }
+
+        bitboard_search(&next, search);
+        if (search->count >= search->limit) {
+            return;
+        }
+    }
+}
+
+size_t bitboard_solve(const uint8_t puzzle[], uint8_t solution[],
+                      size_t limit) {
+    if (puzzle == NULL || limit == 0) {
+        return 0;
+    }
+
+    struct Bitboard board;
+    if (!bitboard_load_puzzle(&board, puzzle) || !bitboard_propagate(&board)) {
+        return 0;
+    }
+
+    struct Search search = {
+        .solution = solution, .count = 0, .limit = limit
+    };
+    bitboard_search(&board, &search);
+    return search.count;
+}
@@ -0,0 +1,73 @@
+/**
+ * @file generator.c
+ * @brief Sudoku puzzle generation implementation.
+ * @author Harley Coughlin
+ * @copyright Copyright (c) 2025 Harley Coughlin
+ * @license MIT
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "../include/generator.h"
+#include "../include/rater.h"
+#include "../include/solver.h"
+#include "../include/grid.h"
+
+/**
+ * @brief Fisher-Yates shuffle of a byte array.
+ */
+static void shuffle(uint8_t values[], size_t amount) {
+    for (size_t i = amount - 1; i > 0; i--) {
+        size_t j = (size_t)rand() % (i + 1);
+        uint8_t tmp = values[i];
+        values[i] = values[j];
+        values[j] = tmp;
+    }
+}
+
+void generate_solution(uint8_t solution[]) {
+    uint8_t puzzle[grid_size] = { 0 };
+    uint8_t digits[grid_width];
+
+    for (size_t non = 0; non < 3; non++) {
+        for (size_t i = 0; i < grid_width; i++) {
+            digits[i] = (uint8_t)(i + 1);
+        }
+        shuffle(digits, grid_width);
+
+        size_t corner = non * ((3 * grid_width) + 3);
+        for (size_t k = 0; k < grid_width; k++) {
+            puzzle[corner + ((k / 3) * grid_width) + (k % 3)] = digits[k];
+        }
+    }
+
+    // Any filling of the diagonal nondrants can be completed.
+    solve_puzzle(engine_bitboard, puzzle, solution, 1);
+}
+
+bool generate_puzzle(const uint8_t solution[], uint8_t puzzle[],
+                     enum Technique min, enum Technique max) {
+    uint8_t order[grid_size];
+    for (size_t i = 0; i < grid_size; i++) {
+        order[i] = (uint8_t)i;
+    }
+    shuffle(order, grid_size);
+
+    memcpy(puzzle, solution, grid_size);
+    enum RateVerdict verdict = rate_under;
+    for (size_t i = 0; i < grid_size; i++) {
+        uint8_t cell = order[i];
+        uint8_t given = puzzle[cell];
+        puzzle[cell] = 0;
+
+        enum RateVerdict next = rate_filter(puzzle, min, max);
+        if (next == rate_over) {
+            puzzle[cell] = given;
+        } else {
+            verdict = next;
+        }
+    }
+
+    return verdict == rate_within;
+}
@@ -0,0 +1,412 @@
+/**
+ * @file parallel.c
+ * @brief Multithreaded work-splitting search implementation.
+ * @author Harley Coughlin
+ * @copyright Copyright (c) 2025 Harley Coughlin
+ * @license MIT
+ */
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "../include/parallel.h"
+#include "../include/solver.h"
+#include "../include/grid.h"
+#include "../include/cell.h"
+
+#define task_deque_capacity 256
+
+/**
+ * @struct Task
+ * @brief A subtree of the search, the cells before the branch is taken and
+ *        the value to collapse the branching cell to.
+ */
+struct Task {
+    /** The cells of the grid at the branch point. */
+    uint16_t cells[grid_size];
+
+    /** The cell to collapse, grid_size to search the cells as they are. */
+    size_t index;
+
+    /** The value to collapse the cell to. */
+    enum Entropy entropy;
+};
+
+/**
+ * @struct TaskDeque
+ * @brief Ring buffer of tasks, the owner works on the tail and thieves take
+ *        from the head so they get the biggest subtrees.
+ */
+struct TaskDeque {
+    pthread_mutex_t lock;
+    struct Task *tasks;
+    size_t head;
+    size_t size;
+};
+
+struct Pool;
+
+/**
+ * @struct Worker
+ * @brief Everything a worker thread owns.
+ */
+struct Worker {
+    struct Pool *pool;
+    pthread_t thread;
+    size_t index;
+
+    /** The tasks split off by this worker. */
+    struct TaskDeque deque;
+
+    /** The worker's own grid, tasks get copied into its cells. */
+    struct Grid grid;
+
+    /** Solutions counted by this worker, merged once every worker is done. */
+    size_t count;
+};
+
+/**
+ * @struct Pool
+ * @brief State shared between the workers of a single parallel_solve.
+ */
+struct Pool {
+    struct Worker *workers;
+    size_t worker_count;
+    enum ParallelMode mode;
+
+    /** Tasks queued or being worked on, the search is done when it's 0. */
+    atomic_size_t pending;
+
+    /** Workers that are looking for a task. */
+    atomic_size_t idle;
+
+    /** Set once the search should stop early. */
+    atomic_bool cancelled;
+
+    /** Set by the first worker to find a solution. */
+    atomic_bool solution_found;
+    uint8_t *solution;
+
+    /** Idle workers sleep on work_ready until the generation changes. */
+    pthread_mutex_t wake_lock;
+    pthread_cond_t work_ready;
+
+    /** Bumped whenever idle workers have something new to look at. */
+    atomic_size_t generation;
+};
+
+static bool task_deque_init(struct TaskDeque *deque) {
+    deque->tasks = malloc(task_deque_capacity * sizeof(struct Task));
+    if (deque->tasks == NULL) {
+        return false;
+    }
+    deque->head = 0;
+    deque->size = 0;
+    if (pthread_mutex_init(&deque->lock, NULL) != 0) {
+        free(deque->tasks);
+        return false;
+    }
+    return true;
+}
+
+static void task_deque_destroy(struct TaskDeque *deque) {
+    pthread_mutex_destroy(&deque->lock);
+    free(deque->tasks);
+}
+
+/**
+ * @brief Pushes a task onto the tail of the deque.
+ * @returns false if the deque is full.
+ */
+static bool task_deque_push(struct TaskDeque *deque, const uint16_t cells[],
+                            size_t index, enum Entropy entropy) {
+    pthread_mutex_lock(&deque->lock);
+    if (deque->size == task_deque_capacity) {
+        pthread_mutex_unlock(&deque->lock);
+        return false;
+    }
+
+    struct Task *task =
+        &deque->tasks[(deque->head + deque->size) % task_deque_capacity];
+    memcpy(task->cells, cells, sizeof(task->cells));
+    task->index = index;
+    task->entropy = entropy;
+    deque->size++;
+
+    pthread_mutex_unlock(&deque->lock);
+    return true;
+}
+
+/**
+ * @brief Takes the newest task (owner) or the oldest task (thief).
+ * @returns false if the deque is empty.
+ */
+static bool task_deque_take(struct TaskDeque *deque, bool steal,
+                            struct Task *out) {
+    pthread_mutex_lock(&deque->lock);
+    if (deque->size == 0) {
+        pthread_mutex_unlock(&deque->lock);
+        return false;
+    }
+
+    size_t slot;
+    if (steal) {
+        slot = deque->head;
+        deque->head = (deque->head + 1) % task_deque_capacity;
+    } else {
+        slot = (deque->head + deque->size - 1) % task_deque_capacity;
+    }
+    deque->size--;
+    memcpy(out, &deque->tasks[slot], sizeof(*out));
+
+    pthread_mutex_unlock(&deque->lock);
+    return true;
+}
+
+/**
+ * @brief Looks for a task in the worker's own deque, then in everyone else's.
+ */
+static bool find_task(struct Worker *worker, struct Task *out) {
+    if (task_deque_take(&worker->deque, false, out)) {
+        return true;
+    }
+
+    struct Pool *pool = worker->pool;
+    for (size_t i = 1; i < pool->worker_count; i++) {
+        struct Worker *victim =
+            &pool->workers[(worker->index + i) % pool->worker_count];
+        if (task_deque_take(&victim->deque, true, out)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * @brief Wakes the idle workers, after new tasks are queued, the search runs
+ *        out of tasks, or it gets cancelled.
+ */
+static void wake_idle_workers(struct Pool *pool) {
+    pthread_mutex_lock(&pool->wake_lock);
+    atomic_fetch_add(&pool->generation, 1);
+    pthread_cond_broadcast(&pool->work_ready);
+    pthread_mutex_unlock(&pool->wake_lock);
+}
+
+static void record_solution(struct Worker *worker) {
+    struct Pool *pool = worker->pool;
+    worker->count++;
+
+    bool expected = false;
+    if (atomic_compare_exchange_strong(&pool->solution_found, &expected,
+                                       true)) {
+        if (pool->solution != NULL) {
+            grid_to_digits(&worker->grid, pool->solution);
+        }
+        if (pool->mode == parallel_first) {
+            atomic_store(&pool->cancelled, true);
+            wake_idle_workers(pool);
+        }
+    }
+}
+
+/**
+ * @brief Depth first search like grid_search, but hands the other branches
+ *        of a branch point to the pool while some worker is idle.
+ */
+static void worker_search(struct Worker *worker) {
+    struct Pool *pool = worker->pool;
+    if (atomic_load_explicit(&pool->cancelled, memory_order_relaxed)) {
+        return;
+    }
+
+    size_t branch_cell;
+    enum SearchState state = grid_settle(&worker->grid, &branch_cell);
+    if (state == search_dead_end) {
+        return;
+    }
+    if (state == search_solved) {
+        record_solution(worker);
+        return;
+    }
+
+    enum Entropy values[enum_entropy_size];
+    uint8_t amount = get_entropy_values(&worker->grid.cells[branch_cell],
+                                        values);
+
+    uint16_t saved[grid_size];
+    memcpy(saved, worker->grid.cells, sizeof(saved));
+
+    // Keep the first value for ourselves and split off the rest, pushed
+    // from the last value down so the owner pops them back in order.
+    if (amount > 1 && atomic_load_explicit(&pool->idle,
+                                           memory_order_relaxed) > 0) {
+        uint8_t kept = amount;
+        while (amount > 1) {
+            atomic_fetch_add(&pool->pending, 1);
+            if (!task_deque_push(&worker->deque, saved, branch_cell,
+                                 values[amount - 1])) {
+                atomic_fetch_sub(&pool->pending, 1);
+                break;
+            }
+            amount--;
+        }
+        if (amount < kept) {
+            wake_idle_workers(pool);
+        }
+    }
+
+    for (uint8_t i = 0; i < amount; i++) {
+        if (i > 0) {
+            memcpy(worker->grid.cells, saved, sizeof(saved));
+        }
+        grid_place(&worker->grid, branch_cell, values[i]);
+        worker_search(worker);
+        if (atomic_load_explicit(&pool->cancelled, memory_order_relaxed)) {
+            return;
+        }
+    }
+}
+
+static void *worker_run(void *arg) {
+    struct Worker *worker = arg;
+    struct Pool *pool = worker->pool;
+    struct Task task;
+    bool idle = false;
+
+    while (!atomic_load(&pool->cancelled)) {
+        // Read before looking so a push that lands after the look still
+        // changes it and can't be slept through.
+        size_t seen = atomic_load(&pool->generation);
+        if (find_task(worker, &task)) {
+            if (idle) {
+                atomic_fetch_sub(&pool->idle, 1);
+                idle = false;
+            }
+
+            memcpy(worker->grid.cells, task.cells, sizeof(task.cells));
+            if (task.index == grid_size ||
+                grid_place(&worker->grid, task.index, task.entropy)) {
+                worker_search(worker);
+            }
+            if (atomic_fetch_sub(&pool->pending, 1) == 1) {
+                wake_idle_workers(pool);
+            }
+            continue;
+        }
+
+        // Nothing queued and nothing running means nothing left to split.
+        if (atomic_load(&pool->pending) == 0) {
+            break;
+        }
+        if (!idle) {
+            atomic_fetch_add(&pool->idle, 1);
+            idle = true;
+        }
+
+        pthread_mutex_lock(&pool->wake_lock);
+        while (atomic_load(&pool->generation) == seen &&
+               atomic_load(&pool->pending) != 0 &&
+               !atomic_load(&pool->cancelled)) {
+            pthread_cond_wait(&pool->work_ready, &pool->wake_lock);
+        }
+        pthread_mutex_unlock(&pool->wake_lock);
+    }
+
+    if (idle) {
+        atomic_fetch_sub(&pool->idle, 1);
+    }
+    return NULL;
+}
+
+size_t parallel_solve(const uint8_t puzzle[], uint8_t solution[],
+                      enum ParallelMode mode, size_t thread_count) {
+    if (puzzle == NULL) {
+        return 0;
+    }
+
+    if (thread_count == 0) {
+        long online = sysconf(_SC_NPROCESSORS_ONLN);
+        thread_count = online > 0 ? (size_t)online : 1;
+    }
+
+    struct Pool pool = {
+        .worker_count = thread_count, .mode = mode, .solution = solution
+    };
+    atomic_init(&pool.pending, 0);
+    atomic_init(&pool.idle, 0);
+    atomic_init(&pool.cancelled, false);
+    atomic_init(&pool.solution_found, false);
+    atomic_init(&pool.generation, 0);
+
+    if (pthread_mutex_init(&pool.wake_lock, NULL) != 0) {
+        return 0;
+    }
+    if (pthread_cond_init(&pool.work_ready, NULL) != 0) {
+        pthread_mutex_destroy(&pool.wake_lock);
+        return 0;
+    }
+
+    pool.workers = calloc(thread_count, sizeof(struct Worker));
+    if (pool.workers == NULL) {
+        pthread_cond_destroy(&pool.work_ready);
+        pthread_mutex_destroy(&pool.wake_lock);
+        return 0;
+    }
+
+    size_t ready = 0;
+    for (; ready < thread_count; ready++) {
+        struct Worker *worker = &pool.workers[ready];
+        worker->pool = &pool;
+        worker->index = ready;
+        initialize_grid(&worker->grid);
+        if (!task_deque_init(&worker->deque)) {
+            break;
+        }
+    }
+
+    size_t count = 0;
+    if (ready == thread_count &&
+        grid_load_puzzle(&pool.workers[0].grid, puzzle)) {
+        // The root task is the loaded puzzle as is.
+        atomic_store(&pool.pending, 1);
+        task_deque_push(&pool.workers[0].deque, pool.workers[0].grid.cells,
+                        grid_size, zero);
+
+        size_t started = 0;
+        for (; started < thread_count; started++) {
+            struct Worker *worker = &pool.workers[started];
+            if (pthread_create(&worker->thread, NULL, worker_run,
+                               worker) != 0) {
+                break;
+            }
+        }
+        for (size_t i = 0; i < started; i++) {
+            pthread_join(pool.workers[i].thread, NULL);
+        }
+
+        // Workers steal from every deque, so as long as one of them got
+        // started the whole tree was searched.
+        if (started > 0) {
+            for (size_t i = 0; i < started; i++) {
+                count += pool.workers[i].count;
+            }
+            if (mode == parallel_first && count > 1) {
+                count = 1;
+            }
+        }
+    }
+
+    for (size_t i = 0; i < ready; i++) {
+        task_deque_destroy(&pool.workers[i].deque);
+    }
+    free(pool.workers);
+    pthread_cond_destroy(&pool.work_ready);
+    pthread_mutex_destroy(&pool.wake_lock);
+    return count;
+}
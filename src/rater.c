@@ -0,0 +1,442 @@
+/**
+ * @file rater.c
+ * @brief Technique based sudoku difficulty rating implementation.
+ * @author Harley Coughlin
+ * @copyright Copyright (c) 2025 Harley Coughlin
+ * @license MIT
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "../include/rater.h"
+#include "../include/solver.h"
+#include "../include/grid.h"
+#include "../include/cell.h"
+
+#define unit_count 27
+#define max_subset_size 4
+
+/**
+ * @struct Unit
+ * @brief A row, column, or nondrant and where each value can still go.
+ *
+ * @details Positions are 9 bit masks of the cells in the unit, bit k is
+ *          cells[k]. Values are masks in the same layout as a cell.
+ */
+struct Unit {
+    uint16_t *cells[grid_width];
+
+    /** The cells each value can still go in, indexed by enum Entropy. */
+    uint16_t positions[enum_entropy_size];
+
+    /** Cells that aren't collapsed yet. */
+    uint16_t open;
+
+    /** Values that have been collapsed somewhere in the unit. */
+    uint16_t placed;
+};
+
+/**
+ * @brief Fills in a unit, 0-8 are rows, 9-17 columns, 18-26 nondrants.
+ */
+static void load_unit(struct Grid *grid, size_t unit, struct Unit *out) {
+    size_t u = unit % grid_width;
+    for (size_t k = 0; k < grid_width; k++) {
+        if (unit < 9) {
+            out->cells[k] = grid->rows[u] + k;
+        } else if (unit < 18) {
+            out->cells[k] = grid->cols[u] + (k * grid_width);
+        } else {
+            // The nondrant pointers are to the middle cell.
+            int offset = ((int)(k / 3) - 1) * grid_width + ((int)(k % 3) - 1);
+            out->cells[k] = grid->nons[u] + offset;
+        }
+    }
+
+    out->open = 0;
+    out->placed = 0;
+    for (size_t v = 0; v < enum_entropy_size; v++) {
+        out->positions[v] = 0;
+    }
+
+    for (size_t k = 0; k < grid_width; k++) {
+        uint16_t cell = *out->cells[k];
+        if (is_collapsed(cell)) {
+            out->placed |= cell & entropy_masks[all];
+            continue;
+        }
+        out->open |= (uint16_t)(1u << k);
+        for (size_t v = one; v <= nine; v++) {
+            if (is_valid_entropy(cell, entropies[v])) {
+                out->positions[v] |= (uint16_t)(1u << k);
+            }
+        }
+    }
+}
+
+static inline size_t cell_index(struct Grid *grid, uint16_t *cell) {
+    return (size_t)(cell - grid->cells);
+}
+
+/**
+ * @brief Removes a value from a cell that isn't collapsed.
+ * @returns true if the value was there to remove.
+ */
+static bool eliminate(uint16_t *cell, enum Entropy entropy) {
+    if (is_collapsed(*cell) || !is_valid_entropy(*cell, entropy)) {
+        return false;
+    }
+    remove_entropy_value(cell, entropy);
+    return true;
+}
+
+static bool apply_naked_singles(struct Grid *grid) {
+    enum Entropy values[enum_entropy_size];
+    bool progress = false;
+    for (size_t i = 0; i < grid_size; i++) {
+        if (!is_collapsed(grid->cells[i]) &&
+            get_entropy_count(grid->cells[i]) == 1) {
+            get_entropy_values(&grid->cells[i], values);
+            grid_place(grid, i, values[0]);
+            progress = true;
+        }
+    }
+    return progress;
+}
+
+static bool apply_hidden_singles(struct Grid *grid) {
+    struct Unit unit;
+    for (size_t u = 0; u < unit_count; u++) {
+        load_unit(grid, u, &unit);
+        for (size_t v = one; v <= nine; v++) {
+            uint16_t pos = unit.positions[v];
+            if ((unit.placed & entropy_masks[v]) ||
+                get_entropy_count(pos) != 1) {
+                continue;
+            }
+            uint16_t *cell = unit.cells[__builtin_ctz(pos)];
+            grid_place(grid, cell_index(grid, cell), entropies[v]);
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Removes a value from the cells of a unit outside of a mask.
+ */
+static bool eliminate_outside(struct Grid *grid, size_t unit, uint16_t keep,
+                              enum Entropy entropy) {
+    struct Unit target;
+    load_unit(grid, unit, &target);
+    bool progress = false;
+    for (size_t k = 0; k < grid_width; k++) {
+        if (!(keep & (1u << k))) {
+            progress |= eliminate(target.cells[k], entropy);
+        }
+    }
+    return progress;
+}
+
+static bool apply_locked_candidates(struct Grid *grid) {
+    struct Unit unit;
+    for (size_t u = 0; u < unit_count; u++) {
+        load_unit(grid, u, &unit);
+        size_t n = u % grid_width;
+        for (size_t v = one; v <= nine; v++) {
+            uint16_t pos = unit.positions[v];
+            if (pos == 0) {
+                continue;
+            }
+
+            for (size_t s = 0; s < 3; s++) {
+                uint16_t line = (uint16_t)(0x7u << (s * 3));
+                uint16_t stack = (uint16_t)(0x49u << s);
+                if (u < 18 && !(pos & ~line)) {
+                    // Box/line reduction, the row/col only has the value
+                    // within one nondrant. Bit k of a column is row k.
+                    size_t non = (u < 9) ? ((n / 3) * 3) + s
+                                         : (s * 3) + (n / 3);
+                    uint16_t keep = (u < 9)
+                        ? (uint16_t)(0x7u << ((n % 3) * 3))
+                        : (uint16_t)(0x49u << (n % 3));
+                    if (eliminate_outside(grid, 18 + non, keep,
+                                          entropies[v])) {
+                        return true;
+                    }
+                }
+                if (u >= 18 && !(pos & ~line)) {
+                    // Pointing, the nondrant only has the value in one row.
+                    size_t row = ((n / 3) * 3) + s;
+                    uint16_t keep = (uint16_t)(0x7u << ((n % 3) * 3));
+                    if (eliminate_outside(grid, row, keep, entropies[v])) {
+                        return true;
+                    }
+                }
+                if (u >= 18 && !(pos & ~stack)) {
+                    // Pointing, the nondrant only has the value in one col.
+                    size_t col = ((n % 3) * 3) + s;
+                    uint16_t keep = (uint16_t)(0x7u << ((n / 3) * 3));
+                    if (eliminate_outside(grid, 9 + col, keep,
+                                          entropies[v])) {
+                        return true;
+                    }
+                }
+            }
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Spreads a combination over a set, bit j of the combination picks
+ *        the j-th lowest bit of the set.
+ */
+static uint16_t spread(unsigned combination, uint16_t set) {
+    uint16_t out = 0;
+    for (; combination != 0; combination >>= 1) {
+        if (combination & 1u) {
+            out |= set & (uint16_t)-set;
+        }
+        set &= (uint16_t)(set - 1);
+    }
+    return out;
+}
+
+/**
+ * @brief The next bigger number with the same amount of bits set.
+ */
+static inline unsigned next_combination(unsigned combination) {
+    unsigned low = combination & -combination;
+    unsigned ripple = combination + low;
+    return ripple | (((combination ^ ripple) >> 2) / low);
+}
+
+/**
+ * @brief Clears the values of a naked subset from the rest of the unit.
+ * @param subset The cells of the subset.
+ */
+static bool eliminate_naked_subset(struct Grid *grid, size_t u,
+                                   struct Unit *unit, uint16_t subset) {
+    uint16_t values = 0;
+    for (size_t k = 0; k < grid_width; k++) {
+        if (subset & (1u << k)) {
+            values |= *unit->cells[k] & entropy_masks[all];
+        }
+    }
+    if (get_entropy_count(values) != get_entropy_count(subset)) {
+        return false;
+    }
+
+    bool progress = false;
+    for (size_t v = one; v <= nine; v++) {
+        if (values & entropy_masks[v]) {
+            progress |= eliminate_outside(grid, u, subset, entropies[v]);
+        }
+    }
+    return progress;
+}
+
+/**
+ * @brief Clears every other value from the cells of a hidden subset.
+ * @param subset The values of the subset.
+ */
+static bool eliminate_hidden_subset(struct Unit *unit, uint16_t subset) {
+    uint16_t cells = 0;
+    for (size_t v = one; v <= nine; v++) {
+        if (subset & entropy_masks[v]) {
+            cells |= unit->positions[v];
+        }
+    }
+    if (get_entropy_count(cells) != get_entropy_count(subset)) {
+        return false;
+    }
+
+    // Those cells can only hold the values of the subset.
+    bool progress = false;
+    for (size_t k = 0; k < grid_width; k++) {
+        if (!(cells & (1u << k))) {
+            continue;
+        }
+        for (size_t v = one; v <= nine; v++) {
+            if (!(subset & entropy_masks[v])) {
+                progress |= eliminate(unit->cells[k], entropies[v]);
+            }
+        }
+    }
+    return progress;
+}
+
+static bool apply_naked_subsets(struct Grid *grid, size_t size) {
+    struct Unit unit;
+    for (size_t u = 0; u < unit_count; u++) {
+        load_unit(grid, u, &unit);
+        // Subsets of the open cells only. One holding every open cell has
+        // nothing left to eliminate from.
+        size_t open = get_entropy_count(unit.open);
+        if (size >= open) {
+            continue;
+        }
+        for (unsigned c = (1u << size) - 1; c < (1u << open);
+             c = next_combination(c)) {
+            if (eliminate_naked_subset(grid, u, &unit,
+                                       spread(c, unit.open))) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+static bool apply_hidden_subsets(struct Grid *grid, size_t size) {
+    struct Unit unit;
+    for (size_t u = 0; u < unit_count; u++) {
+        load_unit(grid, u, &unit);
+        // Subsets of the values not placed yet.
+        uint16_t unplaced = entropy_masks[all] & ~unit.placed;
+        size_t open = get_entropy_count(unplaced);
+        if (size >= open) {
+            continue;
+        }
+        for (unsigned c = (1u << size) - 1; c < (1u << open);
+             c = next_combination(c)) {
+            if (eliminate_hidden_subset(&unit, spread(c, unplaced))) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+/**
+ * @struct Step
+ * @brief One technique, and for subsets their size, in the order rate_grid
+ *        tries them.
+ */
+struct Step {
+    enum Technique technique;
+    size_t size;
+};
+
+/**
+ * @brief Every step from cheapest to most expensive. Subsets go by size, a
+ *        hidden pair is far cheaper to look for than a naked quad.
+ */
+static const struct Step steps[] = {
+    { technique_naked_single, 0 },
+    { technique_hidden_single, 0 },
+    { technique_locked_candidates, 0 },
+    { technique_naked_subset, 2 },
+    { technique_hidden_subset, 2 },
+    { technique_naked_subset, 3 },
+    { technique_hidden_subset, 3 },
+    { technique_naked_subset, max_subset_size },
+    { technique_hidden_subset, max_subset_size },
+};
+#define step_count (sizeof(steps) / sizeof(steps[0]))
+
+static bool apply_step(struct Grid *grid, const struct Step *step) {
+    switch (step->technique) {
+        case technique_naked_single:
+            return apply_naked_singles(grid);
+        case technique_hidden_single:
+            return apply_hidden_singles(grid);
+        case technique_locked_candidates:
+            return apply_locked_candidates(grid);
+        case technique_naked_subset:
+            return apply_naked_subsets(grid, step->size);
+        case technique_hidden_subset:
+            return apply_hidden_subsets(grid, step->size);
+        default:
+            return false;
+    }
+}
+
+/**
+ * @brief Checks whether there are no uncollapsed cells left.
+ */
+static bool grid_is_full(struct Grid *grid) {
+    for (size_t i = 0; i < grid_size; i++) {
+        if (!is_collapsed(grid->cells[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Checks whether every cell is collapsed to a value that fits.
+ * @note propagate_collapse strips the value of a collapsed cell when a peer
+ *       collapses to the same value, so a clash shows up as no entropy.
+ */
+static bool grid_is_solved(struct Grid *grid) {
+    for (size_t i = 0; i < grid_size; i++) {
+        if (!is_collapsed(grid->cells[i]) ||
+            get_entropy_count(grid->cells[i]) == 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+enum Technique rate_grid(struct Grid *grid, enum Technique ceiling) {
+    if (grid == NULL) {
+        return technique_beyond;
+    }
+
+    // Steps past the last one within the ceiling can't change the verdict.
+    size_t end = step_count;
+    while (end > 0 && steps[end - 1].technique > ceiling) {
+        end--;
+    }
+
+    enum Technique hardest = technique_none;
+    size_t i = 0;
+    while (i < end) {
+        if (apply_step(grid, &steps[i])) {
+            // A hidden pair above the ceiling still has to be ruled out
+            // before a naked triple, or the rating would depend on it.
+            if (steps[i].technique > ceiling) {
+                return technique_beyond;
+            }
+            if (steps[i].technique > hardest) {
+                hardest = steps[i].technique;
+            }
+            i = 0;
+        } else if (i == 0 && grid_is_full(grid)) {
+            // Nothing left to solve, don't scan the finished grid.
+            break;
+        } else {
+            i++;
+        }
+    }
+
+    return grid_is_solved(grid) ? hardest : technique_beyond;
+}
+
+enum Technique rate_puzzle(const uint8_t puzzle[]) {
+    struct Grid grid;
+    initialize_grid(&grid);
+    if (!grid_load_puzzle(&grid, puzzle)) {
+        return technique_beyond;
+    }
+    return rate_grid(&grid, technique_hidden_subset);
+}
+
+enum RateVerdict rate_filter(const uint8_t puzzle[], enum Technique min,
+                             enum Technique max) {
+    struct Grid grid;
+    initialize_grid(&grid);
+    if (!grid_load_puzzle(&grid, puzzle)) {
+        return rate_over;
+    }
+
+    // rate_grid stops as soon as the grid is full, so an easy puzzle comes
+    // back under without trying the techniques up to max.
+    enum Technique rating = rate_grid(&grid, max);
+    if (rating == technique_beyond || rating > max) {
+        return rate_over;
+    }
+    return rating < min ? rate_under : rate_within;
+}
@@ -0,0 +1,30 @@
+/**
+ * @file search.h
+ * @brief Search bookkeeping shared by the solving engines.
+ * @author Harley Coughlin
+ * @copyright Copyright (c) 2025 Harley Coughlin
+ * @license MIT
+ */
+
+#ifndef SRC_SEARCH_H_
+#define SRC_SEARCH_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+/**
+ * @struct Search
+ * @brief Bookkeeping shared by every level of an engine's search.
+ */
+struct Search {
+    /** Receives the first solution found, may be NULL. */
+    uint8_t *solution;
+
+    /** The number of solutions found so far. */
+    size_t count;
+
+    /** The number of solutions to stop at. */
+    size_t limit;
+};
+
+#endif  // SRC_SEARCH_H_
@@ -0,0 +1,240 @@
+/**
+ * @file solver.c
+ * @brief Sudoku puzzle solving implementation.
+ * @author Harley Coughlin
+ * @copyright Copyright (c) 2025 Harley Coughlin
+ * @license MIT
+ */
+
+#include <stddef.h>
+#include <string.h>
+
+#include "../include/solver.h"
+#include "../include/bitboard.h"
+#include "../include/grid.h"
+#include "../include/cell.h"
+#include "./search.h"
+
+static void grid_search(struct Grid *grid, struct Search *search);
+
+bool parse_puzzle(const char *str, uint8_t puzzle[]) {
+    if (str == NULL || puzzle == NULL) {
+        return false;
+    }
+
+    for (size_t i = 0; i < grid_size; i++) {
+        char c = str[i];
+        if (c == '.' || c == '0') {
+            puzzle[i] = 0;
+        } else if (c >= '1' && c <= '9') {
+            puzzle[i] = (uint8_t)(c - '0');
+        } else {
+            // Also catches the string ending early.
+            return false;
+        }
+    }
+
+    return true;
+}
+
+size_t solve_puzzle(enum SolverEngine engine, const uint8_t puzzle[],
+                    uint8_t solution[], size_t limit) {
+    if (puzzle == NULL || limit == 0) {
+        return 0;
+    }
+
+    if (engine == engine_bitboard) {
+        return bitboard_solve(puzzle, solution, limit);
+    }
+
+    struct Grid grid;
+    initialize_grid(&grid);
+    if (!grid_load_puzzle(&grid, puzzle)) {
+        return 0;
+    }
+
+    struct Search search = {
+        .solution = solution, .count = 0, .limit = limit
+    };
+    grid_search(&grid, &search);
+    return search.count;
+}
+
+bool grid_load_puzzle(struct Grid *grid, const uint8_t puzzle[]) {
+    if (grid == NULL || puzzle == NULL) {
+        return false;
+    }
+
+    grid_reset_cells(grid);
+    for (size_t i = 0; i < grid_size; i++) {
+        if (puzzle[i] == 0) {
+            continue;
+        }
+        if (puzzle[i] > 9 || !grid_place(grid, i, entropies[puzzle[i]])) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool grid_place(struct Grid *grid, size_t index, enum Entropy entropy) {
+    if (collapse(&grid->cells[index], entropy) != (int8_t)entropy) {
+        return false;
+    }
+
+    propagate_collapse(grid, index / grid_width, index % grid_width, entropy);
+    return true;
+}
+
+/**
+ * @brief The index of the k-th cell of a unit, 0-8 are rows, 9-17 columns,
+ *        18-26 nondrants.
+ */
+static inline size_t unit_cell(size_t unit, size_t k) {
+    size_t u = unit % grid_width;
+    if (unit < 9) {
+        return (u * grid_width) + k;
+    }
+    if (unit < 18) {
+        return (k * grid_width) + u;
+    }
+    return ((((u / 3) * 3) + (k / 3)) * grid_width) + ((u % 3) * 3) + (k % 3);
+}
+
+/**
+ * @brief Collapses the first value in each unit that has one cell left.
+ * @returns The amount of cells collapsed, -1 if a value has nowhere to go.
+ */
+static int place_hidden_singles(struct Grid *grid) {
+    int placed = 0;
+    for (size_t unit = 0; unit < 27; unit++) {
+        uint16_t once = 0, twice = 0, done = 0;
+        for (size_t k = 0; k < grid_width; k++) {
+            uint16_t cell = grid->cells[unit_cell(unit, k)];
+            uint16_t values = cell & entropy_masks[all];
+            if (is_collapsed(cell)) {
+                done |= values;
+            } else {
+                twice |= once & values;
+                once |= values;
+            }
+        }
+        if ((once | done) != entropy_masks[all]) {
+            return -1;
+        }
+
+        uint16_t hidden = once & ~twice & ~done;
+        if (hidden == 0) {
+            continue;
+        }
+        // Only the lowest one, collapsing it changes the rest of the unit.
+        hidden &= (uint16_t)-hidden;
+        for (size_t k = 0; k < grid_width; k++) {
+            size_t i = unit_cell(unit, k);
+            if (!is_collapsed(grid->cells[i]) && (grid->cells[i] & hidden)) {
+                grid_place(grid, i, entropies[__builtin_ctz(hidden) + 1]);
+                placed++;
+                break;
+            }
+        }
+    }
+    return placed;
+}
+
+enum SearchState grid_settle(struct Grid *grid, size_t *branch_cell) {
+    enum Entropy values[enum_entropy_size];
+    size_t best_cell;
+    size_t best_count;
+    bool progress = true;
+
+    while (progress) {
+        progress = false;
+        best_cell = grid_size;
+        best_count = enum_entropy_size;
+
+        for (size_t i = 0; i < grid_size; i++) {
+            size_t count = get_entropy_count(grid->cells[i]);
+            // propagate_collapse also strips a collapsed cell's own value
+            // when a peer collapses to the same value, so this catches
+            // collapsed cells that clash as well.
+            if (count == 0) {
+                return search_dead_end;
+            }
+            if (is_collapsed(grid->cells[i])) {
+                continue;
+            }
+            if (count == 1) {
+                get_entropy_values(&grid->cells[i], values);
+                grid_place(grid, i, values[0]);
+                progress = true;
+            } else if (count < best_count) {
+                best_count = count;
+                best_cell = i;
+            }
+        }
+
+        if (!progress && best_cell != grid_size) {
+            int placed = place_hidden_singles(grid);
+            if (placed < 0) {
+                return search_dead_end;
+            }
+            progress = placed > 0;
+        }
+    }
+
+    if (best_cell == grid_size) {
+        return search_solved;
+    }
+
+    *branch_cell = best_cell;
+    return search_branch;
+}
+
+void grid_to_digits(struct Grid *grid, uint8_t digits[]) {
+    enum Entropy values[enum_entropy_size];
+    for (size_t i = 0; i < grid_size; i++) {
+        if (is_collapsed(grid->cells[i]) &&
+            get_entropy_values(&grid->cells[i], values) == 1) {
+            digits[i] = (uint8_t)values[0];
+        } else {
+            digits[i] = 0;
+        }
+    }
+}
+
+/**
+ * @brief Depth first search over the cell with the least entropy.
+ * @note Backtracks by restoring the cells, the row/col/non pointers of the
+ *       grid stay valid since they never move.
+ */
+static void grid_search(struct Grid *grid, struct Search *search) {
+    size_t branch_cell;
+    enum SearchState state = grid_settle(grid, &branch_cell);
+    if (state == search_dead_end) {
+        return;
+    }
+    if (state == search_solved) {
+        if (search->count == 0 && search->solution != NULL) {
+            grid_to_digits(grid, search->solution);
+        }
+        search->count++;
+        return;
+    }
+
+    enum Entropy values[enum_entropy_size];
+    uint8_t amount = get_entropy_values(&grid->cells[branch_cell], values);
+
+    uint16_t saved[grid_size];
+    memcpy(saved, grid->cells, sizeof(saved));
+    for (uint8_t i = 0; i < amount; i++) {
+        if (i > 0) {
+            memcpy(grid->cells, saved, sizeof(saved));
+        }
+        grid_place(grid, branch_cell, values[i]);
+        grid_search(grid, search);
+        if (search->count >= search->limit) {
+            return;
+        }
+    }
+}
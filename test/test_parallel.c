@@ -0,0 +1,74 @@
+#include <criterion/criterion.h>
+#include <criterion/new/assert.h>
+#include "../include/parallel.h"
+#include "../include/solver.h"
+
+static const char *hard =
+    "8..........36......7..9.2...5...7.......457.....1...3...1....68..85...1..9....4..";
+static const char *hard_solution =
+    "812753649943682175675491283154237896369845721287169534521974368438526917796318452";
+// The hard puzzle without the 4 at index 78, it has 849 solutions.
+static const char *few_givens =
+    "8..........36......7..9.2...5...7.......457.....1...3...1....68..85...1..9.......";
+
+///////////////////////////////////////////////////
+TestSuite(ParallelFirst);
+Test(ParallelFirst, test_first_single_thread) {
+    uint8_t puzzle[grid_size], solution[grid_size], expected[grid_size];
+    parse_puzzle(hard, puzzle);
+    parse_puzzle(hard_solution, expected);
+    cr_assert(eq(ulong, parallel_solve(puzzle, solution, parallel_first, 1),
+                 1));
+    cr_assert(eq(u8[grid_size], solution, expected));
+}
+
+Test(ParallelFirst, test_first_many_threads) {
+    uint8_t puzzle[grid_size], solution[grid_size], expected[grid_size];
+    parse_puzzle(hard, puzzle);
+    parse_puzzle(hard_solution, expected);
+    cr_assert(eq(ulong, parallel_solve(puzzle, solution, parallel_first, 4),
+                 1));
+    cr_assert(eq(u8[grid_size], solution, expected));
+}
+
+Test(ParallelFirst, test_first_contradiction) {
+    uint8_t puzzle[grid_size];
+    parse_puzzle(hard, puzzle);
+    // Put a second 8 in the first row.
+    puzzle[1] = 8;
+    cr_assert(eq(ulong, parallel_solve(puzzle, NULL, parallel_first, 4), 0));
+}
+
+Test(ParallelFirst, test_first_many_solutions) {
+    uint8_t puzzle[grid_size], solution[grid_size], check[grid_size];
+    parse_puzzle(few_givens, puzzle);
+    // Every worker can find a solution, the first one cancels the rest.
+    cr_assert(eq(ulong, parallel_solve(puzzle, solution, parallel_first, 4),
+                 1));
+    // A valid, complete grid is its own only solution.
+    cr_assert(eq(ulong, solve_puzzle(engine_grid, solution, check, 2), 1));
+    cr_assert(eq(u8[grid_size], solution, check));
+    for (size_t i = 0; i < grid_size; i++) {
+        if (puzzle[i] != 0) {
+            cr_assert(eq(u8, solution[i], puzzle[i]));
+        }
+    }
+}
+
+//////////////////////////////////////////////////
+TestSuite(ParallelCount);
+Test(ParallelCount, test_count_unique) {
+    uint8_t puzzle[grid_size];
+    parse_puzzle(hard, puzzle);
+    cr_assert(eq(ulong, parallel_solve(puzzle, NULL, parallel_count, 4), 1));
+}
+
+Test(ParallelCount, test_count_matches_sequential) {
+    uint8_t puzzle[grid_size];
+    parse_puzzle(few_givens, puzzle);
+    size_t expected = solve_puzzle(engine_grid, puzzle, NULL, SIZE_MAX);
+    for (size_t threads = 1; threads <= 8; threads *= 2) {
+        size_t count = parallel_solve(puzzle, NULL, parallel_count, threads);
+        cr_assert(eq(ulong, count, expected), "%zu threads", threads);
+    }
+}
@@ -0,0 +1,142 @@
+#include <criterion/criterion.h>
+#include <criterion/new/assert.h>
+#include <stdlib.h>
+#include "../include/rater.h"
+#include "../include/generator.h"
+#include "../include/solver.h"
+
+static const char *naked_single =
+    "..3.2.6..9..3.5..1..18.64....81.29..7.......8..67.82....26.95..8..2.3..9..5.1.3..";
+static const char *hidden_single =
+    "000000010400000000020000000000050407008000300001090000300400200050100000000806000";
+static const char *locked_candidates =
+    "4.....8.5.3..........7......2.....6.....8.4......1.......6.3.7.5..2.....1.4......";
+static const char *naked_subset =
+    "...14.....97.....2..1.95.4..34.268...7.....9...........5....9.63..5.......2.8..51";
+static const char *hidden_subset =
+    "...4......2..6...1....91..5.....9.3.8.....4.234...7.6.58.1.......152...46........";
+static const char *beyond =
+    "8..........36......7..9.2...5...7.......457.....1...3...1....68..85...1..9....4..";
+
+///////////////////////////////////////////////////
+TestSuite(RatePuzzle);
+Test(RatePuzzle, test_rate_solved) {
+    uint8_t puzzle[grid_size], solution[grid_size];
+    parse_puzzle(naked_single, puzzle);
+    solve_puzzle(engine_grid, puzzle, solution, 1);
+    cr_assert(eq(int, rate_puzzle(solution), technique_none));
+}
+
+Test(RatePuzzle, test_rate_naked_single) {
+    uint8_t puzzle[grid_size];
+    parse_puzzle(naked_single, puzzle);
+    cr_assert(eq(int, rate_puzzle(puzzle), technique_naked_single));
+}
+
+Test(RatePuzzle, test_rate_hidden_single) {
+    uint8_t puzzle[grid_size];
+    parse_puzzle(hidden_single, puzzle);
+    cr_assert(eq(int, rate_puzzle(puzzle), technique_hidden_single));
+}
+
+Test(RatePuzzle, test_rate_locked_candidates) {
+    uint8_t puzzle[grid_size];
+    parse_puzzle(locked_candidates, puzzle);
+    cr_assert(eq(int, rate_puzzle(puzzle), technique_locked_candidates));
+}
+
+Test(RatePuzzle, test_rate_naked_subset) {
+    uint8_t puzzle[grid_size];
+    parse_puzzle(naked_subset, puzzle);
+    cr_assert(eq(int, rate_puzzle(puzzle), technique_naked_subset));
+}
+
+Test(RatePuzzle, test_rate_hidden_subset) {
+    uint8_t puzzle[grid_size];
+    parse_puzzle(hidden_subset, puzzle);
+    cr_assert(eq(int, rate_puzzle(puzzle), technique_hidden_subset));
+    cr_assert(eq(ulong, solve_puzzle(engine_bitboard, puzzle, NULL, 2), 1));
+}
+
+Test(RatePuzzle, test_rate_beyond) {
+    uint8_t puzzle[grid_size];
+    parse_puzzle(beyond, puzzle);
+    cr_assert(eq(int, rate_puzzle(puzzle), technique_beyond));
+}
+
+Test(RatePuzzle, test_rate_contradiction) {
+    uint8_t puzzle[grid_size];
+    parse_puzzle(naked_single, puzzle);
+    // Put a second 3 in the first row.
+    puzzle[0] = 3;
+    cr_assert(eq(int, rate_puzzle(puzzle), technique_beyond));
+}
+
+Test(RatePuzzle, test_rate_multiple_solutions) {
+    uint8_t puzzle[grid_size] = { 0 };
+    cr_assert(eq(int, rate_puzzle(puzzle), technique_beyond));
+}
+
+//////////////////////////////////////////////////
+TestSuite(RateFilter);
+Test(RateFilter, test_filter_within) {
+    uint8_t puzzle[grid_size];
+    parse_puzzle(locked_candidates, puzzle);
+    cr_assert(eq(int, rate_filter(puzzle, technique_hidden_single,
+                                  technique_naked_subset), rate_within));
+}
+
+Test(RateFilter, test_filter_under) {
+    uint8_t puzzle[grid_size];
+    parse_puzzle(naked_single, puzzle);
+    cr_assert(eq(int, rate_filter(puzzle, technique_hidden_single,
+                                  technique_naked_subset), rate_under));
+}
+
+Test(RateFilter, test_filter_over) {
+    uint8_t puzzle[grid_size];
+    parse_puzzle(naked_subset, puzzle);
+    cr_assert(eq(int, rate_filter(puzzle, technique_naked_single,
+                                  technique_locked_candidates), rate_over));
+}
+
+Test(RateFilter, test_filter_over_naked_subset) {
+    uint8_t puzzle[grid_size];
+    parse_puzzle(hidden_subset, puzzle);
+    cr_assert(eq(int, rate_filter(puzzle, technique_naked_single,
+                                  technique_naked_subset), rate_over));
+}
+
+//////////////////////////////////////////////////
+TestSuite(Generate);
+Test(Generate, test_generate_solution) {
+    uint8_t solution[grid_size], check[grid_size];
+    srand(1);
+    generate_solution(solution);
+    for (size_t i = 0; i < grid_size; i++) {
+        cr_assert(solution[i] >= 1 && solution[i] <= 9);
+    }
+    // A complete, valid grid is its own only solution.
+    cr_assert(eq(ulong, solve_puzzle(engine_grid, solution, check, 2), 1));
+    cr_assert(eq(u8[grid_size], solution, check));
+}
+
+Test(Generate, test_generate_puzzle_in_tier) {
+    uint8_t solution[grid_size], puzzle[grid_size], check[grid_size];
+    srand(1);
+    size_t made = 0;
+    for (size_t attempt = 0; attempt < 50 && made < 5; attempt++) {
+        generate_solution(solution);
+        if (!generate_puzzle(solution, puzzle, technique_hidden_single,
+                             technique_locked_candidates)) {
+            continue;
+        }
+        made++;
+        enum Technique rating = rate_puzzle(puzzle);
+        cr_assert(rating >= technique_hidden_single);
+        cr_assert(rating <= technique_locked_candidates);
+        cr_assert(eq(ulong, solve_puzzle(engine_grid, puzzle, check, 2), 1));
+        cr_assert(eq(u8[grid_size], solution, check));
+    }
+    cr_assert(eq(ulong, made, 5));
+}
@@ -0,0 +1,131 @@
+#include <criterion/criterion.h>
+#include <criterion/new/assert.h>
+#include <string.h>
+#include "../include/solver.h"
+#include "../include/bitboard.h"
+
+static const char *easy =
+    "..3.2.6..9..3.5..1..18.64....81.29..7.......8..67.82....26.95..8..2.3..9..5.1.3..";
+static const char *easy_solution =
+    "483921657967345821251876493548132976729564138136798245372689514814253769695417382";
+static const char *hard =
+    "8..........36......7..9.2...5...7.......457.....1...3...1....68..85...1..9....4..";
+static const char *hard_solution =
+    "812753649943682175675491283154237896369845721287169534521974368438526917796318452";
+// Solved by naked and hidden singles alone.
+static const char *singles =
+    "000000010400000000020000000000050407008000300001090000300400200050100000000806000";
+
+///////////////////////////////////////////////////
+TestSuite(ParsePuzzle);
+Test(ParsePuzzle, test_parse_dots_and_zeros) {
+    uint8_t puzzle[grid_size];
+    cr_assert(parse_puzzle(easy, puzzle));
+    cr_assert(eq(u8, puzzle[0], 0));
+    cr_assert(eq(u8, puzzle[2], 3));
+    cr_assert(eq(u8, puzzle[80], 0));
+}
+
+Test(ParsePuzzle, test_parse_short_string) {
+    uint8_t puzzle[grid_size];
+    cr_assert(not(parse_puzzle("123", puzzle)));
+}
+
+Test(ParsePuzzle, test_parse_invalid_character) {
+    uint8_t puzzle[grid_size];
+    char str[grid_size + 1];
+    memcpy(str, easy, sizeof(str));
+    str[40] = 'x';
+    cr_assert(not(parse_puzzle(str, puzzle)));
+}
+
+//////////////////////////////////////////////////
+TestSuite(SolveGrid);
+Test(SolveGrid, test_solve_easy) {
+    uint8_t puzzle[grid_size], solution[grid_size], expected[grid_size];
+    parse_puzzle(easy, puzzle);
+    parse_puzzle(easy_solution, expected);
+    size_t count = solve_puzzle(engine_grid, puzzle, solution, 2);
+    cr_assert(eq(ulong, count, 1));
+    cr_assert(eq(u8[grid_size], solution, expected));
+}
+
+Test(SolveGrid, test_solve_hard) {
+    uint8_t puzzle[grid_size], solution[grid_size], expected[grid_size];
+    parse_puzzle(hard, puzzle);
+    parse_puzzle(hard_solution, expected);
+    size_t count = solve_puzzle(engine_grid, puzzle, solution, 2);
+    cr_assert(eq(ulong, count, 1));
+    cr_assert(eq(u8[grid_size], solution, expected));
+}
+
+Test(SolveGrid, test_solve_contradiction) {
+    uint8_t puzzle[grid_size];
+    parse_puzzle(easy, puzzle);
+    // Put a second 3 in the first row.
+    puzzle[0] = 3;
+    cr_assert(eq(ulong, solve_puzzle(engine_grid, puzzle, NULL, 1), 0));
+}
+
+Test(SolveGrid, test_solve_empty_hits_limit) {
+    uint8_t puzzle[grid_size] = { 0 };
+    cr_assert(eq(ulong, solve_puzzle(engine_grid, puzzle, NULL, 10), 10));
+}
+
+Test(SolveGrid, test_settle_hidden_singles) {
+    uint8_t puzzle[grid_size];
+    struct Grid grid;
+    size_t branch_cell;
+    parse_puzzle(singles, puzzle);
+    initialize_grid(&grid);
+    cr_assert(grid_load_puzzle(&grid, puzzle));
+    cr_assert(eq(int, grid_settle(&grid, &branch_cell), search_solved));
+}
+
+//////////////////////////////////////////////////
+TestSuite(SolveBitboard);
+Test(SolveBitboard, test_solve_easy) {
+    uint8_t puzzle[grid_size], solution[grid_size], expected[grid_size];
+    parse_puzzle(easy, puzzle);
+    parse_puzzle(easy_solution, expected);
+    size_t count = solve_puzzle(engine_bitboard, puzzle, solution, 2);
+    cr_assert(eq(ulong, count, 1));
+    cr_assert(eq(u8[grid_size], solution, expected));
+}
+
+Test(SolveBitboard, test_solve_hard) {
+    uint8_t puzzle[grid_size], solution[grid_size], expected[grid_size];
+    parse_puzzle(hard, puzzle);
+    parse_puzzle(hard_solution, expected);
+    size_t count = solve_puzzle(engine_bitboard, puzzle, solution, 2);
+    cr_assert(eq(ulong, count, 1));
+    cr_assert(eq(u8[grid_size], solution, expected));
+}
+
+Test(SolveBitboard, test_solve_contradiction) {
+    uint8_t puzzle[grid_size];
+    parse_puzzle(easy, puzzle);
+    puzzle[0] = 3;
+    cr_assert(eq(ulong, solve_puzzle(engine_bitboard, puzzle, NULL, 1), 0));
+}
+
+Test(SolveBitboard, test_solve_empty_hits_limit) {
+    uint8_t puzzle[grid_size] = { 0 };
+    cr_assert(eq(ulong, solve_puzzle(engine_bitboard, puzzle, NULL, 10), 10));
+}
+
+Test(SolveBitboard, test_place_eliminates_peers) {
+    struct Bitboard board;
+    bitboard_initialize(&board);
+    // Row 4, column 4 is bit 13 (row 1 of the band * 9 + column 4) of the
+    // middle band.
+    cr_assert(bitboard_place(&board, 40, 5));
+    // Same row, column, and nondrant can't take a 5 anymore.
+    cr_assert(not(bitboard_place(&board, 36, 5)));
+    cr_assert(not(bitboard_place(&board, 4, 5)));
+    cr_assert(not(bitboard_place(&board, 50, 5)));
+    // The cell itself can't take anything else.
+    cr_assert(not(bitboard_place(&board, 40, 1)));
+    // Unrelated cells are fine.
+    cr_assert(bitboard_place(&board, 0, 5));
+}